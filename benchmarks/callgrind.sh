@@ -0,0 +1,52 @@
+#!/bin/bash
+#
+# Count instructions per validation with callgrind.
+#
+# Usage:
+#   benchmarks/callgrind.sh [PHP_BINARY] [OUTPUT_JSON]
+#
+# Every case runs twice per side, with ITERATIONS and with no timed iterations.
+# The difference divided by ITERATIONS is the instruction count per call, free
+# of startup and warm-up cost. The JSON has the same layout as run.php --json,
+# so compare.php works on both.
+#
+
+set -e
+
+PHP="${1:-./php-src/sapi/cli/php}"
+OUT="${2:-callgrind.json}"
+ITERATIONS="${ITERATIONS:-2000}"
+DIR="$(cd "$(dirname "$0")" && pwd)"
+
+instructions() {
+    local log
+    log="$(mktemp)"
+    valgrind --tool=callgrind --callgrind-out-file=/dev/null \
+        "$PHP" -n "$DIR/run.php" --case="$1" --side="$2" --iterations="$3" 2> "$log"
+    sed -n 's/.*Collected : \([0-9]*\).*/\1/p' "$log"
+    rm -f "$log"
+}
+
+CASES="$("$PHP" -n -r 'echo implode(" ", array_keys(require $argv[1])), "\n";' "$DIR/cases.php")"
+
+{
+    echo '{'
+    echo "  \"php\": \"$("$PHP" -n -r 'echo PHP_VERSION;')\","
+    echo "  \"iterations\": $ITERATIONS,"
+    echo '  "cases": {'
+    first=1
+    for name in $CASES; do
+        typed=$(( ($(instructions "$name" typed "$ITERATIONS") - $(instructions "$name" typed 0)) / ITERATIONS ))
+        plain=$(( ($(instructions "$name" plain "$ITERATIONS") - $(instructions "$name" plain 0)) / ITERATIONS ))
+        [ $first -eq 1 ] || echo ','
+        first=0
+        printf '    "%s": {"typed_ir": %d, "plain_ir": %d, "overhead_ir": %d}' \
+            "$name" "$typed" "$plain" $(( typed - plain ))
+        echo "$name: $(( typed - plain )) instructions/op" >&2
+    done
+    echo
+    echo '  }'
+    echo '}'
+} > "$OUT"
+
+echo "Wrote $OUT"
@@ -0,0 +1,153 @@
+<?php
+/**
+ * Benchmark cases, one per validator path in Zend/zend_execute.c.
+ *
+ * Every case has a typed function and a plain twin taking `array`, called with
+ * the same input. The runner reports the difference, so call overhead and the
+ * work done by the function body cancel out.
+ *
+ * 'input' is built once. 'mutate' (optional) runs before every call on both
+ * sides and changes the array, which drops its validation cache and forces a
+ * full scan ("miss" cases).
+ */
+
+spl_autoload_register(function (string $name): void {
+    $file = __DIR__ . "/shapes/$name.php";
+    if (is_file($file)) {
+        require $file;
+    }
+});
+
+class BenchItem { public function __construct(public int $id = 0) {} }
+class BenchItemA extends BenchItem {}
+class BenchItemB extends BenchItem {}
+
+shape BenchPoint = array{x: int, y: int};
+shape BenchUser = array{id: int, name: string, email: string, age?: int};
+shape BenchClosed = array{id: int, name: string}!;
+shape BenchOrder = array{id: int, customer: BenchUser, total: float};
+shape BenchAdmin extends BenchUser = array{role: string};
+shape BenchCard = array{kind: string, number: string};
+shape BenchBank = array{kind: string, iban: string};
+shape BenchResult<T> = array{success: bool, data: T};
+
+function plain(array $a): int { return 1; }
+
+function packed_int(array<int> $a): int { return 1; }
+function packed_float(array<float> $a): int { return 1; }
+function packed_string(array<string> $a): int { return 1; }
+function hash_int(array<int> $a): int { return 1; }
+function keyed_string_int(array<string, int> $a): int { return 1; }
+function object_exact(array<BenchItem> $a): int { return 1; }
+function object_subclass(array<BenchItem> $a): int { return 1; }
+function union_elements(array<int|string> $a): int { return 1; }
+function nested_lists(array<array<int>> $a): int { return 1; }
+function inline_shape(array{x: int, y: int} $a): int { return 1; }
+function named_shape(BenchUser $a): int { return 1; }
+function nested_shape(BenchOrder $a): int { return 1; }
+function inherited_shape(BenchAdmin $a): int { return 1; }
+function closed_shape(BenchClosed $a): int { return 1; }
+function autoloaded_shape(AutoloadedRecord $a): int { return 1; }
+function union_shapes(BenchCard|BenchBank $a): int { return 1; }
+function generic_shape(BenchResult<int> $a): int { return 1; }
+function return_shape(array $a): BenchPoint { return $a; }
+function return_plain(array $a): array { return $a; }
+
+class BenchHolder {
+    public array<int> $ints = [];
+    public BenchUser $user = ['id' => 0, 'name' => '', 'email' => ''];
+    public array $plainInts = [];
+    public array $plainUser = [];
+}
+
+function closed_shape_extra(array $a): int {
+    try {
+        closed_shape($a);
+    } catch (TypeError) {
+        return 0;
+    }
+    return 1;
+}
+
+function plain_catch(array $a): int {
+    try {
+        plain($a);
+    } catch (TypeError) {
+        return 0;
+    }
+    return 1;
+}
+
+$holder = new BenchHolder;
+
+$user = ['id' => 1, 'name' => 'Ada', 'email' => 'ada@example.com', 'age' => 36];
+$touchFirst = function (array &$a, int $i): void { $a[array_key_first($a)] = $a[array_key_first($a)]; };
+
+return [
+    'packed_int_small' => ['typed' => 'packed_int', 'input' => range(1, 8)],
+    'packed_int_simd' => ['typed' => 'packed_int', 'input' => range(1, 1024)],
+    'packed_int_miss' => ['typed' => 'packed_int', 'input' => range(1, 1024),
+        'mutate' => function (array &$a, int $i): void { $a[0] = $i; }],
+    'packed_float' => ['typed' => 'packed_float', 'input' => array_fill(0, 1024, 1.5),
+        'mutate' => function (array &$a, int $i): void { $a[0] = (float) $i; }],
+    'packed_string' => ['typed' => 'packed_string', 'input' => array_fill(0, 1024, 'x'),
+        'mutate' => function (array &$a, int $i): void { $a[0] = 'y'; }],
+    'hash_int' => ['typed' => 'hash_int', 'input' => array_combine(range(1024, 1), range(1, 1024)),
+        'mutate' => function (array &$a, int $i): void { $a[1] = $i; }],
+    'keyed_string_int' => ['typed' => 'keyed_string_int',
+        'input' => array_combine(array_map(fn($i) => "k$i", range(1, 256)), range(1, 256)),
+        'mutate' => function (array &$a, int $i): void { $a['k1'] = $i; }],
+    'object_monomorphic' => ['typed' => 'object_exact',
+        'input' => array_map(fn($i) => new BenchItem($i), range(1, 256)),
+        'mutate' => $touchFirst],
+    'object_polymorphic' => ['typed' => 'object_subclass',
+        'input' => array_map(fn($i) => $i % 2 ? new BenchItemA($i) : new BenchItemB($i), range(1, 256)),
+        'mutate' => $touchFirst],
+    'union_elements' => ['typed' => 'union_elements',
+        'input' => array_map(fn($i) => $i % 2 ? $i : "s$i", range(1, 256)),
+        'mutate' => $touchFirst],
+    'nested_lists' => ['typed' => 'nested_lists', 'input' => array_fill(0, 32, range(1, 32)),
+        'mutate' => $touchFirst],
+    'inline_shape' => ['typed' => 'inline_shape', 'input' => ['x' => 1, 'y' => 2],
+        'mutate' => function (array &$a, int $i): void { $a['x'] = $i; }],
+    'named_shape_hit' => ['typed' => 'named_shape', 'input' => $user],
+    'named_shape_miss' => ['typed' => 'named_shape', 'input' => $user,
+        'mutate' => function (array &$a, int $i): void { $a['id'] = $i; }],
+    'nested_shape' => ['typed' => 'nested_shape',
+        'input' => ['id' => 1, 'customer' => $user, 'total' => 9.5],
+        'mutate' => function (array &$a, int $i): void { $a['id'] = $i; }],
+    'inherited_shape' => ['typed' => 'inherited_shape', 'input' => $user + ['role' => 'admin'],
+        'mutate' => function (array &$a, int $i): void { $a['id'] = $i; }],
+    'closed_shape' => ['typed' => 'closed_shape', 'input' => ['id' => 1, 'name' => 'a'],
+        'mutate' => function (array &$a, int $i): void { $a['id'] = $i; }],
+    'closed_shape_extra_key' => ['typed' => 'closed_shape_extra', 'plain' => 'plain_catch',
+        'input' => ['id' => 1, 'name' => 'a', 'extra' => true]],
+    'autoloaded_shape' => ['typed' => 'autoloaded_shape',
+        'input' => ['id' => 1, 'label' => 'a', 'active' => true],
+        'mutate' => function (array &$a, int $i): void { $a['id'] = $i; }],
+    'union_shapes' => ['typed' => 'union_shapes', 'input' => ['kind' => 'bank', 'iban' => 'X'],
+        'mutate' => function (array &$a, int $i): void { $a['kind'] = 'bank'; }],
+    'generic_shape' => ['typed' => 'generic_shape', 'input' => ['success' => true, 'data' => 1],
+        'mutate' => function (array &$a, int $i): void { $a['data'] = $i; }],
+    'return_shape' => ['typed' => 'return_shape', 'plain' => 'return_plain', 'input' => ['x' => 1, 'y' => 2],
+        'mutate' => function (array &$a, int $i): void { $a['x'] = $i; }],
+    'property_typed_array' => [
+        'typed' => function (array $a) use ($holder): int { $holder->ints = $a; return 1; },
+        'plain' => function (array $a) use ($holder): int { $holder->plainInts = $a; return 1; },
+        'input' => range(1, 256),
+        'mutate' => function (array &$a, int $i): void { $a[0] = $i; }],
+    'property_shape' => [
+        'typed' => function (array $a) use ($holder): int { $holder->user = $a; return 1; },
+        'plain' => function (array $a) use ($holder): int { $holder->plainUser = $a; return 1; },
+        'input' => $user,
+        'mutate' => function (array &$a, int $i): void { $a['id'] = $i; }],
+    'shape_matches' => [
+        'typed' => fn(array $a): int => (int) shape_matches($a, BenchUser::shape),
+        'plain' => fn(array $a): int => (int) is_array($a),
+        'input' => $user,
+        'mutate' => function (array &$a, int $i): void { $a['id'] = $i; }],
+    'shape_coerce' => [
+        'typed' => fn(array $a): int => count(shape_coerce($a, BenchPoint::shape)),
+        'plain' => fn(array $a): int => count($a),
+        'input' => ['x' => '1', 'y' => '2']],
+];
@@ -0,0 +1,60 @@
+<?php
+/**
+ * Compare two benchmark reports (run.php --json or callgrind.sh output).
+ *
+ * Usage:
+ *   php benchmarks/compare.php BASE.json NEW.json [--threshold=PERCENT]
+ *
+ * Every overhead_* metric present in both reports is compared. Cases whose
+ * overhead grew by more than the threshold (default 10%) and by more than a
+ * noise floor are listed as regressions, and the exit status is 1.
+ */
+
+$threshold = 10.0;
+$files = [];
+foreach (array_slice($argv, 1) as $arg) {
+    if (str_starts_with($arg, '--threshold=')) {
+        $threshold = (float) substr($arg, strlen('--threshold='));
+    } else {
+        $files[] = $arg;
+    }
+}
+if (count($files) !== 2) {
+    fwrite(STDERR, "Usage: php compare.php BASE.json NEW.json [--threshold=PERCENT]\n");
+    exit(2);
+}
+
+[$base, $new] = array_map(function (string $file): array {
+    $report = json_decode((string) file_get_contents($file), true);
+    if (!is_array($report) || !isset($report['cases'])) {
+        fwrite(STDERR, "$file is not a benchmark report\n");
+        exit(2);
+    }
+    return $report['cases'];
+}, $files);
+
+/* Differences below this are timer or scheduling noise, not regressions */
+$noise = ['overhead_ns' => 2.0, 'overhead_ir' => 20];
+$regressions = 0;
+
+printf("%-26s %-12s %12s %12s %9s\n", 'case', 'metric', 'base', 'new', 'change');
+foreach ($new as $name => $metrics) {
+    foreach ($metrics as $metric => $value) {
+        if (!str_starts_with($metric, 'overhead_') || !isset($base[$name][$metric])) {
+            continue;
+        }
+        $before = $base[$name][$metric];
+        $delta = $value - $before;
+        $percent = $before != 0 ? $delta / abs($before) * 100 : 0.0;
+        $regressed = $delta > ($noise[$metric] ?? 0) && $percent > $threshold;
+        $regressions += $regressed;
+        printf("%-26s %-12s %12.2f %12.2f %+8.1f%%%s\n",
+            $name, $metric, $before, $value, $percent, $regressed ? '  REGRESSION' : '');
+    }
+}
+
+foreach (array_diff_key($base, $new) as $name => $_) {
+    echo "$name: missing from the new report\n";
+}
+
+exit($regressions ? 1 : 0);
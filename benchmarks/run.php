@@ -0,0 +1,101 @@
+<?php
+/**
+ * Typed array and array shape micro-benchmarks.
+ *
+ * Usage:
+ *   php benchmarks/run.php [--filter=REGEX] [--iterations=N] [--repeat=N] [--json=FILE]
+ *   php benchmarks/run.php --case=NAME --side=typed|plain --iterations=N   (used by callgrind.sh)
+ *
+ * For every case the typed function and its plain twin are timed with the same
+ * input. ns/op is the median over --repeat runs, "overhead" is typed minus
+ * plain. bytes/op is the memory still allocated after the loop divided by the
+ * iteration count, anything above zero points at a leak or an unbounded cache.
+ */
+
+$options = getopt('', ['filter:', 'iterations:', 'repeat:', 'json:', 'case:', 'side:']);
+$cases = require __DIR__ . '/cases.php';
+$iterations = (int) ($options['iterations'] ?? 200000);
+$repeat = max(1, (int) ($options['repeat'] ?? 5));
+
+function bench_side(array $case, string $side, int $iterations): array
+{
+    $fn = $case[$side] ?? ($side === 'typed' ? $case['typed'] : 'plain');
+    $mutate = $case['mutate'] ?? null;
+    $input = $case['input'];
+
+    // Warm up: autoloading, runtime caches, first validation of a cache-hit input
+    for ($i = 0; $i < 1000; $i++) {
+        $mutate && $mutate($input, $i);
+        $fn($input);
+    }
+
+    $memory = memory_get_usage();
+    $start = hrtime(true);
+    if ($mutate) {
+        for ($i = 0; $i < $iterations; $i++) {
+            $mutate($input, $i);
+            $fn($input);
+        }
+    } else {
+        for ($i = 0; $i < $iterations; $i++) {
+            $fn($input);
+        }
+    }
+    $elapsed = hrtime(true) - $start;
+
+    return [$elapsed / max(1, $iterations), (memory_get_usage() - $memory) / max(1, $iterations)];
+}
+
+function median(array $values): float
+{
+    sort($values);
+    $n = count($values);
+    return $n % 2 ? $values[intdiv($n, 2)] : ($values[$n / 2 - 1] + $values[$n / 2]) / 2;
+}
+
+// Single side of a single case, for instruction counting under callgrind
+if (isset($options['case'])) {
+    $name = $options['case'];
+    if (!isset($cases[$name])) {
+        fwrite(STDERR, "Unknown case $name\n");
+        exit(1);
+    }
+    bench_side($cases[$name], $options['side'] ?? 'typed', $iterations);
+    exit(0);
+}
+
+$results = [];
+printf("%-26s %12s %12s %12s %10s\n", 'case', 'typed ns/op', 'plain ns/op', 'overhead', 'bytes/op');
+foreach ($cases as $name => $case) {
+    if (isset($options['filter']) && !preg_match('{' . $options['filter'] . '}', $name)) {
+        continue;
+    }
+
+    $typed = $plain = $bytes = [];
+    for ($r = 0; $r < $repeat; $r++) {
+        [$typed[], $bytes[]] = bench_side($case, 'typed', $iterations);
+        [$plain[]] = bench_side($case, 'plain', $iterations);
+    }
+
+    $result = [
+        'typed_ns' => round(median($typed), 2),
+        'plain_ns' => round(median($plain), 2),
+        'overhead_ns' => round(median($typed) - median($plain), 2),
+        'bytes_per_op' => round(max($bytes), 3),
+    ];
+    $results[$name] = $result;
+    printf("%-26s %12.2f %12.2f %12.2f %10.3f\n", $name,
+        $result['typed_ns'], $result['plain_ns'], $result['overhead_ns'], $result['bytes_per_op']);
+}
+
+if (isset($options['json'])) {
+    $report = [
+        'php' => PHP_VERSION,
+        'zts' => PHP_ZTS,
+        'opcache' => function_exists('opcache_get_status') && (opcache_get_status(false)['opcache_enabled'] ?? false),
+        'iterations' => $iterations,
+        'repeat' => $repeat,
+        'cases' => $results,
+    ];
+    file_put_contents($options['json'], json_encode($report, JSON_PRETTY_PRINT) . "\n");
+}
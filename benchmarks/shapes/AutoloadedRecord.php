@@ -0,0 +1,3 @@
+<?php
+
+shape AutoloadedRecord = array{id: int, label: string, active: bool};
@@ -0,0 +1,86 @@
+#!/bin/bash
+#
+# Offline patched vs standard comparison of the showcase benchmark commands.
+#
+# Usage:
+#   ./benchmark.sh [--warmup=N] [--repeat=N] [--callgrind] [--framework=NAME]
+#                  [--count=N] [--pokemon=N]
+#
+# Every HTTP call the commands make is answered from src/fixtures (mounted at
+# /demo/fixtures), so runs need no network and see identical data. Each
+# command runs WARMUP times untimed and then REPEAT times per container; the
+# report gives the mean and 95% confidence interval of every phase. With
+# --callgrind, one more run per command under valgrind records the total
+# instruction count, which does not vary between runs.
+#
+# Needs the four containers from docker-compose.yml to be up.
+#
+
+set -e
+
+WARMUP=2
+REPEAT=10
+CALLGRIND=0
+FRAMEWORKS="laravel symfony"
+COUNT=1000
+POKEMON=20
+
+for arg in "$@"; do
+    case "$arg" in
+        --warmup=*)    WARMUP="${arg#*=}" ;;
+        --repeat=*)    REPEAT="${arg#*=}" ;;
+        --callgrind)   CALLGRIND=1 ;;
+        --framework=*) FRAMEWORKS="${arg#*=}" ;;
+        --count=*)     COUNT="${arg#*=}" ;;
+        --pokemon=*)   POKEMON="${arg#*=}" ;;
+        *) echo "Unknown option: $arg" >&2; exit 2 ;;
+    esac
+done
+
+cd "$(dirname "$0")"
+STAMP="$(date +%Y%m%d-%H%M%S)"
+OUT="src/.bench-results/$STAMP"
+
+command_for() {
+    local framework="$1" bench="$2" console
+    if [ "$framework" = laravel ]; then console=artisan; else console=bin/console; fi
+    case "$bench" in
+        ingest)  echo "$console app:ingest-benchmark --count=$COUNT" ;;
+        pokemon) echo "$console app:pokemon-benchmark --pokemon=$POKEMON" ;;
+    esac
+}
+
+run() {
+    local container="$1"
+    shift
+    docker exec -w /app -e SHOWCASE_FIXTURES=/demo/fixtures "$container" "$@"
+}
+
+for framework in $FRAMEWORKS; do
+    for variant in standard patched; do
+        container="showcase-$framework-$variant"
+        for bench in ingest pokemon; do
+            dir="$OUT/$bench/$framework/$variant"
+            mkdir -p "$dir"
+            # shellcheck disable=SC2207
+            cmd=($(command_for "$framework" "$bench"))
+
+            echo "$container: $bench (warm-up $WARMUP, runs $REPEAT)"
+            for ((i = 1; i <= WARMUP; i++)); do
+                run "$container" php -d memory_limit=512M "${cmd[@]}" > /dev/null
+            done
+            for ((i = 1; i <= REPEAT; i++)); do
+                run "$container" php -d memory_limit=512M "${cmd[@]}" > "$dir/run-$i.txt"
+            done
+
+            if [ "$CALLGRIND" = 1 ]; then
+                run "$container" valgrind --tool=callgrind --callgrind-out-file=/dev/null \
+                    php -d memory_limit=512M "${cmd[@]}" 2>&1 > /dev/null \
+                    | sed -n 's/.*Collected : \([0-9]*\).*/\1/p' > "$dir/callgrind.txt"
+            fi
+        done
+    done
+done
+
+docker exec "showcase-${FRAMEWORKS%% *}-patched" php /demo/bench/report.php "/demo/.bench-results/$STAMP" \
+    | tee "$OUT/report.md"
@@ -2,7 +2,10 @@
 
 namespace App\Providers;
 
+use Illuminate\Http\Client\Request;
+use Illuminate\Support\Facades\Http;
 use Illuminate\Support\ServiceProvider;
+use Showcase\Fixtures\FixtureRouter;
 
 class AppServiceProvider extends ServiceProvider
 {
@@ -19,6 +22,26 @@ public function register(): void
      */
     public function boot(): void
     {
-        //
+        $fixtures = config('services.fixtures.path');
+        if ($fixtures) {
+            $this->answerHttpFromFixtures($fixtures);
+        }
+    }
+
+    /**
+     * Serve PokeAPI, randomuser.me and the job boards from recorded
+     * responses so the benchmark commands run offline and deterministically.
+     * Requests to any other host throw rather than reach the network.
+     */
+    private function answerHttpFromFixtures(string $directory): void
+    {
+        require_once $directory . '/FixtureRouter.php';
+        $router = new FixtureRouter($directory);
+
+        Http::fake(function (Request $request) use ($router) {
+            [$status, $body] = $router->respond($request->url());
+
+            return Http::response($body, $status, ['Content-Type' => 'application/json']);
+        });
     }
 }
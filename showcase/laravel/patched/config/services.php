@@ -35,4 +35,14 @@
         ],
     ],
 
+    'jsearch' => [
+        'api_key' => env('JSEARCH_API_KEY'),
+    ],
+
+    // Directory of recorded API responses (showcase/src/fixtures). When set,
+    // every outbound HTTP request is answered from it instead of the network.
+    'fixtures' => [
+        'path' => env('SHOWCASE_FIXTURES'),
+    ],
+
 ];
@@ -7,6 +7,8 @@
 use App\DTO\UserResponse;
 use App\DTO\UserStats;
 use Illuminate\Console\Command;
+use Illuminate\Http\Client\ConnectionException;
+use Illuminate\Support\Facades\Http;
 
 /**
  * Benchmark command that ingests data from a remote API.
@@ -164,15 +166,14 @@ public function handle(): int
     private function fetchFromApi(int $count): ?string
     {
         $url = sprintf(self::API_URL, min($count, 5000));
-        $context = stream_context_create([
-            'http' => [
-                'timeout' => 30,
-                'user_agent' => 'PHP Benchmark/1.0',
-            ],
-        ]);
-
-        $data = @file_get_contents($url, false, $context);
-        return $data !== false ? $data : null;
+
+        try {
+            $response = Http::timeout(30)->withUserAgent('PHP Benchmark/1.0')->get($url);
+        } catch (ConnectionException) {
+            return null;
+        }
+
+        return $response->successful() ? $response->body() : null;
     }
 
     /**
@@ -0,0 +1,119 @@
+<?php
+/**
+ * Summarise a benchmark.sh results directory as Markdown.
+ *
+ * Usage: php report.php RESULTS_DIR
+ *
+ * RESULTS_DIR/<bench>/<framework>/<variant>/run-N.txt holds the output of one
+ * command run, which ends in the command's JSON summary. Every phase is
+ * reported as mean ± 95% confidence interval (Student's t) over the runs.
+ * The difference is flagged "n.s." when the two intervals overlap.
+ */
+
+if ($argc !== 2 || !is_dir($argv[1])) {
+    fwrite(STDERR, "Usage: php report.php RESULTS_DIR\n");
+    exit(2);
+}
+
+/** Two-sided 95% t critical values for 1..30 degrees of freedom */
+const T95 = [
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+];
+
+/** @return array{mean: float, ci: float} */
+function summarize(array $values): array
+{
+    $n = count($values);
+    $mean = array_sum($values) / $n;
+    if ($n < 2) {
+        return ['mean' => $mean, 'ci' => 0.0];
+    }
+
+    $variance = 0.0;
+    foreach ($values as $v) {
+        $variance += ($v - $mean) ** 2;
+    }
+    $sd = sqrt($variance / ($n - 1));
+
+    return ['mean' => $mean, 'ci' => (T95[$n - 2] ?? 1.960) * $sd / sqrt($n)];
+}
+
+/**
+ * Per-phase timings of every run in a variant directory, keyed by phase.
+ *
+ * @return array<string, list<float>>
+ */
+function load_runs(string $dir): array
+{
+    $phases = [];
+    foreach (glob("$dir/run-*.txt") as $file) {
+        $output = file_get_contents($file);
+        $start = strpos($output, '{', (int) strpos($output, 'JSON Output'));
+        $end = strrpos($output, '}');
+        $json = $start === false ? null : json_decode(substr($output, $start, $end - $start + 1), true);
+        if (!is_array($json)) {
+            fwrite(STDERR, "No JSON summary in $file\n");
+            continue;
+        }
+
+        foreach ($json['results'] + ['total' => $json['total_ms']] as $phase => $ms) {
+            $phases[$phase][] = (float) $ms;
+        }
+    }
+
+    return $phases;
+}
+
+function format_ms(?array $s): string
+{
+    return $s === null ? '—' : sprintf('%.2f ± %.2f', $s['mean'], $s['ci']);
+}
+
+function format_delta(?array $standard, ?array $patched): string
+{
+    if ($standard === null || $patched === null || $standard['mean'] == 0) {
+        return '—';
+    }
+
+    $delta = sprintf('%+.1f%%', ($patched['mean'] - $standard['mean']) / $standard['mean'] * 100);
+    $overlap = abs($patched['mean'] - $standard['mean']) <= $patched['ci'] + $standard['ci'];
+
+    return $overlap ? "$delta (n.s.)" : $delta;
+}
+
+$root = rtrim($argv[1], '/');
+foreach (glob("$root/*", GLOB_ONLYDIR) as $benchDir) {
+    foreach (glob("$benchDir/*", GLOB_ONLYDIR) as $frameworkDir) {
+        $runs = [];
+        $instructions = [];
+        foreach (['standard', 'patched'] as $variant) {
+            $runs[$variant] = load_runs("$frameworkDir/$variant");
+            $ir = @file_get_contents("$frameworkDir/$variant/callgrind.txt");
+            $instructions[$variant] = $ir !== false && trim($ir) !== '' ? (int) $ir : null;
+        }
+
+        $count = count(glob("$frameworkDir/patched/run-*.txt"));
+        printf("### %s / %s (%d runs, ms, mean ± 95%% CI)\n\n", basename($benchDir), basename($frameworkDir), $count);
+        echo "| Phase | Standard | Patched | Difference |\n";
+        echo "|-------|----------|---------|------------|\n";
+
+        $phases = array_unique(array_merge(array_keys($runs['standard']), array_keys($runs['patched'])));
+        foreach ($phases as $phase) {
+            $standard = isset($runs['standard'][$phase]) ? summarize($runs['standard'][$phase]) : null;
+            $patched = isset($runs['patched'][$phase]) ? summarize($runs['patched'][$phase]) : null;
+            printf("| %s | %s | %s | %s |\n", $phase, format_ms($standard), format_ms($patched), format_delta($standard, $patched));
+        }
+
+        if ($instructions['standard'] !== null && $instructions['patched'] !== null) {
+            printf(
+                "| instructions | %s | %s | %+.1f%% |\n",
+                number_format($instructions['standard']),
+                number_format($instructions['patched']),
+                ($instructions['patched'] - $instructions['standard']) / $instructions['standard'] * 100
+            );
+        }
+        echo "\n";
+    }
+}
@@ -0,0 +1,130 @@
+<?php
+
+namespace Showcase\Fixtures;
+
+/**
+ * Answers the showcase's outbound API calls from recorded fixtures.
+ *
+ * Both frameworks route their HTTP clients through this class when
+ * SHOWCASE_FIXTURES points at this directory, so the benchmark commands
+ * run offline and see the same bytes on every run and in every container.
+ * A request to a host without fixtures throws instead of going out to the
+ * network.
+ */
+final class FixtureRouter
+{
+    /** Upstream host => fixture subdirectory and path prefix to strip */
+    private const HOSTS = [
+        'randomuser.me' => ['randomuser', ''],
+        'pokeapi.co' => ['pokeapi', '/api/v2'],
+        'remotive.com' => ['remotive', ''],
+        'www.arbeitnow.com' => ['arbeitnow', ''],
+        'jsearch.p.rapidapi.com' => ['jsearch', ''],
+    ];
+
+    public function __construct(private readonly string $directory)
+    {
+    }
+
+    /**
+     * Resolve a request URL to a status code and JSON body.
+     *
+     * @return array{0: int, 1: string}
+     */
+    public function respond(string $url): array
+    {
+        $host = strtolower((string) parse_url($url, PHP_URL_HOST));
+        if (!isset(self::HOSTS[$host])) {
+            throw new \RuntimeException("No recorded fixtures for {$url}");
+        }
+
+        [$subdir, $prefix] = self::HOSTS[$host];
+        $path = rtrim((string) parse_url($url, PHP_URL_PATH), '/');
+        if ($prefix !== '' && str_starts_with($path, $prefix)) {
+            $path = substr($path, strlen($prefix));
+        }
+        parse_str((string) parse_url($url, PHP_URL_QUERY), $query);
+
+        if ($host === 'pokeapi.co' && preg_match('#^/pokemon/(\d+)$#', $path, $m)) {
+            $path = $this->pokemonPathById((int) $m[1]);
+        }
+
+        $file = $this->directory . '/' . $subdir . $path . '.json';
+        if ($path === '' || str_contains($path, '..') || !is_file($file)) {
+            return [404, json_encode(['detail' => 'Not found.'])];
+        }
+
+        $data = json_decode(file_get_contents($file), true, flags: JSON_THROW_ON_ERROR);
+
+        return [200, json_encode(match ($subdir) {
+            'randomuser' => $this->randomUsers($data, (int) ($query['results'] ?? 1)),
+            'pokeapi' => $path === '/pokemon' ? $this->pokemonPage($data, $query) : $data,
+            'remotive' => isset($query['limit']) ? $this->limitJobs($data, (int) $query['limit']) : $data,
+            default => $data,
+        }, JSON_UNESCAPED_SLASHES | JSON_UNESCAPED_UNICODE)];
+    }
+
+    /**
+     * Expand the recorded users to the requested count. Copies after the
+     * first pass get a unique uuid and username so they aggregate like
+     * distinct people, and the output only depends on $count.
+     */
+    private function randomUsers(array $data, int $count): array
+    {
+        $recorded = $data['results'];
+        $n = count($recorded);
+        $results = [];
+
+        for ($i = 0; $i < $count; $i++) {
+            $user = $recorded[$i % $n];
+            if ($i >= $n) {
+                $copy = intdiv($i, $n);
+                $user['login']['uuid'] = substr($user['login']['uuid'], 0, 24) . sprintf('%012x', $i);
+                $user['login']['username'] .= '_' . $copy;
+            }
+            $results[] = $user;
+        }
+
+        $data['results'] = $results;
+        $data['info']['results'] = $count;
+
+        return $data;
+    }
+
+    private function pokemonPage(array $data, array $query): array
+    {
+        $limit = (int) ($query['limit'] ?? 20);
+        $offset = (int) ($query['offset'] ?? 0);
+        $base = 'https://pokeapi.co/api/v2/pokemon';
+
+        $data['results'] = array_slice($data['results'], $offset, $limit);
+        $data['next'] = $offset + $limit < $data['count']
+            ? "{$base}?offset=" . ($offset + $limit) . "&limit={$limit}"
+            : null;
+        $data['previous'] = $offset > 0
+            ? "{$base}?offset=" . max(0, $offset - $limit) . "&limit={$limit}"
+            : null;
+
+        return $data;
+    }
+
+    private function pokemonPathById(int $id): string
+    {
+        $list = json_decode(file_get_contents($this->directory . '/pokeapi/pokemon.json'), true);
+        foreach ($list['results'] as $item) {
+            if (str_ends_with($item['url'], "/pokemon/{$id}/")) {
+                return '/pokemon/' . $item['name'];
+            }
+        }
+
+        return '/pokemon/' . $id;
+    }
+
+    private function limitJobs(array $data, int $limit): array
+    {
+        $data['jobs'] = array_slice($data['jobs'], 0, $limit);
+        $data['job-count'] = count($data['jobs']);
+
+        return $data;
+    }
+}
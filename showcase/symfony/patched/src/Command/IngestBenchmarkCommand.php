@@ -9,6 +9,8 @@ use Symfony\Component\Console\Input\InputInterface;
 use Symfony\Component\Console\Input\InputOption;
 use Symfony\Component\Console\Output\OutputInterface;
 use Symfony\Component\Console\Style\SymfonyStyle;
+use Symfony\Contracts\HttpClient\Exception\ExceptionInterface;
+use Symfony\Contracts\HttpClient\HttpClientInterface;
 
 /**
  * Benchmark command that ingests data from a remote API.
@@ -115,6 +117,12 @@ class IngestBenchmarkCommand extends Command
 {
     private const API_URL = 'https://randomuser.me/api/?results=%d&seed=benchmark';
 
+    public function __construct(
+        private readonly HttpClientInterface $httpClient,
+    ) {
+        parent::__construct();
+    }
+
     protected function configure(): void
     {
         $this->addOption('count', 'c', InputOption::VALUE_OPTIONAL, 'Number of users to fetch', 1000);
@@ -277,15 +285,15 @@ class IngestBenchmarkCommand extends Command
     private function fetchFromApi(int $count): ?string
     {
         $url = sprintf(self::API_URL, min($count, 5000));
-        $context = stream_context_create([
-            'http' => [
-                'timeout' => 30,
-                'user_agent' => 'PHP Benchmark/1.0',
-            ],
-        ]);
 
-        $data = @file_get_contents($url, false, $context);
-        return $data !== false ? $data : null;
+        try {
+            return $this->httpClient->request('GET', $url, [
+                'timeout' => 30,
+                'headers' => ['User-Agent' => 'PHP Benchmark/1.0'],
+            ])->getContent();
+        } catch (ExceptionInterface) {
+            return null;
+        }
     }
 
     /**
@@ -0,0 +1,62 @@
+<?php
+
+namespace App\HttpClient;
+
+use Showcase\Fixtures\FixtureRouter;
+use Symfony\Component\HttpClient\MockHttpClient;
+use Symfony\Component\HttpClient\Response\MockResponse;
+use Symfony\Contracts\HttpClient\HttpClientInterface;
+use Symfony\Contracts\HttpClient\ResponseInterface;
+use Symfony\Contracts\HttpClient\ResponseStreamInterface;
+
+/**
+ * Decorates the http_client service.
+ *
+ * When SHOWCASE_FIXTURES names the recorded fixture directory
+ * (showcase/src/fixtures), requests are answered from it so the benchmark
+ * commands run offline and deterministically. Requests to any other host
+ * throw rather than reach the network. Otherwise it passes everything
+ * through to the real client.
+ */
+final class FixtureHttpClient implements HttpClientInterface
+{
+    private HttpClientInterface $client;
+
+    public function __construct(HttpClientInterface $inner, ?string $fixturesDir = null)
+    {
+        if ($fixturesDir === null || $fixturesDir === '') {
+            $this->client = $inner;
+            return;
+        }
+
+        require_once $fixturesDir . '/FixtureRouter.php';
+        $router = new FixtureRouter($fixturesDir);
+
+        $this->client = new MockHttpClient(static function (string $method, string $url) use ($router): MockResponse {
+            [$status, $body] = $router->respond($url);
+
+            return new MockResponse($body, [
+                'http_code' => $status,
+                'response_headers' => ['content-type' => 'application/json'],
+            ]);
+        });
+    }
+
+    public function request(string $method, string $url, array $options = []): ResponseInterface
+    {
+        return $this->client->request($method, $url, $options);
+    }
+
+    public function stream(ResponseInterface|iterable $responses, ?float $timeout = null): ResponseStreamInterface
+    {
+        return $this->client->stream($responses, $timeout);
+    }
+
+    public function withOptions(array $options): static
+    {
+        $clone = clone $this;
+        $clone->client = $this->client->withOptions($options);
+
+        return $clone;
+    }
+}